@@ -0,0 +1,68 @@
+// adc_asm.h
+// C declarations for the assembly routines in adc.S
+// The ADC_ settings below are shared with adc.S, so this file is also
+// included from assembly.
+#pragma once
+
+// Result bits, 10 to 12 (-DADC_BITS=11): each result is the sum of
+// 4^(ADC_BITS - 10) conversions shifted right by ADC_BITS - 10.
+#ifndef ADC_BITS
+#define ADC_BITS            12
+#endif
+#define ADC_SHIFT           (ADC_BITS - 10)
+#define ADC_SAMPLES         (1 << (2 * ADC_SHIFT))
+
+// ADC clock prescaler, for 50-200 kHz: 75 kHz at 1.2 MHz (/16) and at
+// 9.6 MHz (/128). A conversion is 13 ADC clocks, 5.8 kHz at 75 kHz.
+#ifndef F_CPU_HZ
+#define F_CPU_HZ            1200000
+#endif
+#ifndef ADC_PRESCALE
+#if F_CPU_HZ <= 2400000
+#define ADC_PRESCALE        16
+#else
+#define ADC_PRESCALE        128
+#endif
+#endif
+#if ADC_PRESCALE == 8
+#define ADC_PS              ((1<<ADPS1) | (1<<ADPS0))
+#elif ADC_PRESCALE == 16
+#define ADC_PS              (1<<ADPS2)
+#elif ADC_PRESCALE == 32
+#define ADC_PS              ((1<<ADPS2) | (1<<ADPS0))
+#elif ADC_PRESCALE == 64
+#define ADC_PS              ((1<<ADPS2) | (1<<ADPS1))
+#else
+#define ADC_PS              ((1<<ADPS2) | (1<<ADPS1) | (1<<ADPS0))
+#endif
+
+// ADC input channels (MUX1:0)
+#define ADC_PB5             0
+#define ADC_PB2             1
+#define ADC_PB4             2
+#define ADC_PB3             3
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Free-running conversions of channel (ADC_PB2 etc.) against VCC, summed
+// in the ADC interrupt. Leaves the pin an input. Enables global
+// interrupts. The first result is ready after ADC_SAMPLES conversions.
+void adc_init(uint8_t channel);
+
+// The latest result, 0 to (1 << ADC_BITS) - 1. Never turns interrupts
+// off: it reads again if a new result came in while it read.
+uint16_t adc_read(void);
+
+// Results so far, counting up by one each and wrapping at 256: a change
+// since the last call means adc_read has a new result.
+uint8_t adc_seq(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
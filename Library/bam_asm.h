@@ -0,0 +1,51 @@
+// bam_asm.h
+// C declarations for the assembly routines in bam.S
+// The BAM_ timer settings below are shared with bam.S, so this file is
+// also included from assembly.
+#pragma once
+
+// Timer0 prescaler. A frame is 510 timer counts, bit n is on for 2 << n of
+// them: 294 Hz at 1.2 MHz (/8) and 9.6 MHz (/64).
+#ifndef F_CPU_HZ
+#define F_CPU_HZ            1200000
+#endif
+#ifndef BAM_PRESCALE
+#if F_CPU_HZ <= 2400000
+#define BAM_PRESCALE        8
+#else
+#define BAM_PRESCALE        64
+#endif
+#endif
+#if BAM_PRESCALE == 8
+#define BAM_CS              (1<<CS01)
+#elif BAM_PRESCALE == 64
+#define BAM_CS              ((1<<CS01) | (1<<CS00))
+#else
+#define BAM_CS              (1<<CS02)
+#endif
+
+// channels, one per pin PB0-PB4
+#define BAM_CHANNELS        5
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Take over Timer0 (CTC, compare A interrupt) and drive the PORTB pins in
+// mask (bits 0-4) as outputs, all off. Enables global interrupts. Don't
+// link with sysclock.S or softpwm.S, which use Timer0 too, and don't
+// write the BAM pins while it runs: it toggles them through PINB.
+void bam_init(uint8_t pins);
+
+// New brightness for all channels, duty[n] for PBn, 0 (off) to 255 (on);
+// pins not given to bam_init stay off. The bit planes are built here and
+// start together with the next frame.
+void bam_write(const uint8_t duty[BAM_CHANNELS]);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,59 @@
+// dds_asm.h
+// C declarations for the assembly routines in dds.S
+// DDS_VOICES is shared with dds.S, so this file is also included from
+// assembly.
+#pragma once
+
+#ifndef F_CPU_HZ
+#define F_CPU_HZ            1200000
+#endif
+
+// voices mixed on OC0A, 1 or 2 (-DDDS_VOICES=2)
+#ifndef DDS_VOICES
+#define DDS_VOICES          1
+#endif
+
+// samples in a wave table, one period
+#define DDS_TABLE           64
+
+// Sample rate: one per Timer0 overflow, no prescaler
+#define DDS_RATE_HZ         (F_CPU_HZ / 256)
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+// Phase step for a tone of hz (a constant, so the double folds away at
+// compile time): hz * 65536 / DDS_RATE_HZ. Up to DDS_RATE_HZ / 2.
+#define DDS_STEP(hz)        ((uint16_t)((hz) * 16777216.0 / F_CPU_HZ + 0.5))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One period of a sine, DDS_TABLE samples from 1 to 255 around 128, in
+// flash. The wave dds_init starts with.
+extern const uint8_t dds_sine[DDS_TABLE] PROGMEM;
+
+// Take over Timer0 (fast PWM, no prescaler, overflow interrupt) and drive
+// OC0A (PB0) as an output at mid level, all voices stopped. Enables global
+// interrupts. Don't link with sysclock.S, softpwm.S or bam.S, which use
+// Timer0 too; wdtclock.S gives ticks() without it (call init_wdtclock
+// first, it uses Timer0 to calibrate).
+void dds_init(void);
+
+// Play voice (0 to DDS_VOICES - 1) at DDS_STEP(hz). Step 0 stops it on the
+// table's first sample, mid level for dds_sine.
+void dds_set(uint8_t voice, uint16_t step);
+
+// Wave for all voices: DDS_TABLE samples of one period, in flash.
+void dds_wave(const uint8_t *table);
+
+// Stop Timer0 and drive PB0 low, for silence with no PWM carrier.
+// dds_init starts again.
+void dds_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
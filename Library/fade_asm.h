@@ -0,0 +1,30 @@
+// fade_asm.h
+// C declarations for the assembly routines in fade.S
+// Needs sysclock.S built with -DSYSCLOCK_PWM=1 -DSYSCLOCK_FADE=1, whose
+// overflow interrupt moves the ramps every tick.
+#pragma once
+
+// channels: 0 is OC0A (PB0), 1 is OC0B (PB1)
+#define FADE_CHANNELS       2
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Ramp channel ch from where it is to level (0-255, perceived brightness)
+// in ms milliseconds (0: at once), and make its pin an output. The PWM
+// duty follows through a gamma 2.2 table, so equal level steps look like
+// equal steps in brightness. Replaces a ramp still running. Don't call
+// pwm_set_a/b for a channel that fades.
+void fade_to(uint8_t ch, uint8_t level, uint16_t ms);
+
+// Channels still ramping, bit 0 for channel 0, bit 1 for channel 1.
+uint8_t fade_busy(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,26 @@
+// format_asm.h
+// C declarations for the assembly routines in format.S
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Write v in decimal via char_write, no division (subtracts powers of ten).
+// The w variants pad with spaces, the z variants with zeros, to at least
+// width characters. Larger values are never truncated.
+void put_u8(uint8_t v);
+void put_u8w(uint8_t v, uint8_t width);
+void put_u8z(uint8_t v, uint8_t width);
+void put_u16(uint16_t v);
+void put_u16w(uint16_t v, uint8_t width);
+void put_u16z(uint16_t v, uint8_t width);
+
+// Write v as 2 (put_hex8) or 4 (put_hex16) upper case hex digits.
+void put_hex8(uint8_t v);
+void put_hex16(uint16_t v);
+
+#ifdef __cplusplus
+}
+#endif
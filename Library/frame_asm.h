@@ -0,0 +1,20 @@
+// frame_asm.h
+// C declarations for the assembly routines in frame.S
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Return the CRC-8/MAXIM (poly 0x31 reflected, init 0) of len bytes at buf.
+uint8_t crc8(const uint8_t *buf, uint8_t len);
+
+// Send len bytes at buf as one COBS frame: payload + CRC8, then a 0x00
+// delimiter. Uses char_write, so init_serial must be called first.
+// len must be 253 or less.
+void frame_send(const uint8_t *buf, uint8_t len);
+
+#ifdef __cplusplus
+}
+#endif
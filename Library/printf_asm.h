@@ -0,0 +1,18 @@
+// printf_asm.h
+// C declarations for the assembly routines in printf.S
+#pragma once
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Write a PROGMEM format string via char_write: %u %x %c %s %S %%, with an
+// optional 0 flag and one width digit (%5u, %02x). Needs format.S.
+//   flash_printf(PSTR("adc %4u osccal %x\r\n"), adc, OSCCAL);
+void flash_printf(const char *fmt, ...);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,74 @@
+// pt.h
+// Protothreads: stackless coroutines for the main loop, in the style of
+// Adam Dunkels' protothreads (a switch statement resumed at the line it
+// last waited on, Duff's device). Header only, no .S file.
+//
+//   static struct pt blink_pt;
+//
+//   static PT_THREAD(blink(struct pt *pt))
+//   {
+//       PT_BEGIN(pt);
+//       for (;;) {
+//           PINB = _BV(LED);
+//           PT_WAIT_TICKS(pt, 125);
+//       }
+//       PT_END(pt);
+//   }
+//
+//   while (1) { blink(&blink_pt); other(&other_pt); }
+//
+// Each thread is 3 bytes of SRAM (its struct pt) and shares the one
+// stack, so local variables do not survive a wait: keep them static or
+// in a struct of your own. PT_ macros may not be used inside a switch
+// of the thread's own. PT_WAIT_TICKS needs sysclock.S (or wdtclock.S).
+#pragma once
+#include <stdint.h>
+#include "sysclock_asm.h"
+
+struct pt {
+    uint8_t lc;                 // resume point, 0 = from the top
+    uint16_t t;                 // PT_WAIT_TICKS start
+};
+
+// thread function results
+#define PT_RUNNING      0
+#define PT_ENDED        1
+
+// uint8_t name, returns PT_RUNNING until the thread reaches PT_END
+#define PT_THREAD(name_args)    uint8_t name_args
+
+// Start (or restart) the thread from the top at its next call.
+#define PT_INIT(pt)             ((pt)->lc = 0)
+
+#define PT_BEGIN(pt)            switch ((pt)->lc) { case 0:
+
+// Return PT_ENDED; the next call starts from the top again.
+#define PT_END(pt)              } (pt)->lc = 0; return PT_ENDED
+
+// Resume points are numbered by __COUNTER__, passed through one more macro
+// so both uses see the same value. More than 255 in one file fails the
+// build: lc is a uint8_t, and PT_CHECK_ says so before -Werror does.
+#define PT_CHECK_(n) \
+    _Static_assert((n) < 256, "pt.h: more than 255 resume points in a file")
+#define PT_WAIT_UNTIL_(pt, cond, n) \
+    do { PT_CHECK_(n); (pt)->lc = (n); case (n): if (!(cond)) return PT_RUNNING; } while (0)
+#define PT_YIELD_(pt, n) \
+    do { PT_CHECK_(n); (pt)->lc = (n); return PT_RUNNING; case (n):; } while (0)
+
+// Return until cond is true, checking it again at every call.
+#define PT_WAIT_UNTIL(pt, cond) PT_WAIT_UNTIL_((pt), (cond), __COUNTER__ + 1)
+
+#define PT_WAIT_WHILE(pt, cond) PT_WAIT_UNTIL((pt), !(cond))
+
+// Return once and carry on at the next call.
+#define PT_YIELD(pt)            PT_YIELD_((pt), __COUNTER__ + 1)
+
+// Return until n ticks (up to 32767) have passed.
+#define PT_WAIT_TICKS(pt, n) \
+    do { \
+        (pt)->t = ticks(); \
+        PT_WAIT_UNTIL((pt), (uint16_t)(ticks() - (pt)->t) >= (uint16_t)(n)); \
+    } while (0)
+
+// Start again from the top at the next call.
+#define PT_RESTART(pt)          do { PT_INIT(pt); return PT_RUNNING; } while (0)
@@ -0,0 +1,63 @@
+// sched_asm.h
+// C declarations for the assembly routines in sched.S
+// SCHED_MAX and SCHED_STATS are shared with sched.S, so this file is also
+// included from assembly. Set them in the example's Makefile
+// (CPPFLAGS += -DSCHED_STATS=1) so C and sched.S agree.
+#pragma once
+
+// most tasks sched_init takes, 2 bytes of SRAM each (4 with SCHED_STATS)
+#ifndef SCHED_MAX
+#define SCHED_MAX       4
+#endif
+// 1: keep an overrun count and the worst lateness per task
+#ifndef SCHED_STATS
+#define SCHED_STATS     0
+#endif
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One table entry, in flash:
+//   const struct sched_task tasks[] PROGMEM = { { blink, 500, 0 }, ... };
+// fn runs every period ticks (1 or more), the first time phase ticks after
+// sched_init. Tasks must return quickly, never block.
+struct sched_task {
+    void (*fn)(void);
+    uint16_t period;
+    uint16_t phase;
+};
+
+// Per-task SRAM record, sched_state[i] belongs to table entry i.
+struct sched_state {
+    uint16_t next;          // tick of the next run
+#if SCHED_STATS
+    uint8_t overruns;       // runs skipped for being a period late, max 255
+    uint8_t max_late;       // worst start delay in ticks, max 255
+#endif
+};
+extern struct sched_state sched_state[SCHED_MAX];
+
+// Use the first n (at most SCHED_MAX) tasks of the flash table and clear
+// the stats. init_sysclock_1k must be running.
+void sched_init(const struct sched_task *table, uint8_t n);
+
+// Run every task that is due, in table order, and return.
+void sched_poll(void);
+
+// The nearest deadline of the tasks as a tick count, already past if a task
+// is overdue. For sysclock_idle(sched_next()) in a loop of your own.
+uint16_t sched_next(void);
+
+// sched_poll forever, for a main loop with nothing else to do. With
+// -DSYSCLOCK_TICKLESS=1 it sleeps in sysclock_idle until the next deadline.
+void sched_run(void) __attribute__((noreturn));
+
+#ifdef __cplusplus
+}
+#endif
+#endif
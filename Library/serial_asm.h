@@ -7,15 +7,20 @@
 extern "C" {
 #endif
 
-// Initialise TX/RX pin directions and idle state.
+// Initialise TX/RX pin directions and idle state, apply TRIM to OSCCAL
+// (or auto-calibrate, see serial_calibrate).
 // Must be called before char_write or char_read.
 void init_serial(void);
 
-// Transmit one byte at 9600-8-N-1.
+// Tune OSCCAL from host 0x55 ('U') sync bytes, return the value applied.
+// Only assembled with -DSERIAL_AUTOCAL=1, where init_serial calls it.
+uint8_t serial_calibrate(void);
+
+// Transmit one byte at SOFT_BAUD-8-N-1 (env.make, 9600 by default).
 // The character is passed in r24 per the AVR-GCC ABI.
 void char_write(uint8_t c);
 
-// Transmit one word at 9600-8-N-1.
+// Transmit one word at SOFT_BAUD-8-N-1, high byte first.
 // The character is passed in r25/r24 per the AVR-GCC ABI.
 void word_write(uint16_t c);
 
@@ -23,6 +28,22 @@ void word_write(uint16_t c);
 // The result is returned in r24 per the AVR-GCC ABI.
 uint8_t char_read(void);
 
+// char_read_timeout / char_read_vote results other than a byte (0-255)
+#define SERIAL_FRAME_ERR    (-1)
+#define SERIAL_TIMEOUT      (-2)
+
+// Wait up to timeout ticks (sysclock.S, 1 ms each) for a byte and return
+// it, SERIAL_TIMEOUT, or SERIAL_FRAME_ERR if its stop bit was low.
+// init_sysclock_1k must be running, 0 returns at once unless a byte is
+// already arriving.
+int16_t char_read_timeout(uint16_t timeout);
+
+// Block until one byte is received, with 3 samples per bit (majority vote)
+// and re-timing on every falling edge. Return it, or SERIAL_FRAME_ERR if the
+// start or stop bit was wrong. Only assembled with -DSERIAL_VOTE=1, where
+// char_read uses it and drops the bad frames.
+int16_t char_read_vote(void);
+
 // Write program memory text to console
 // The address is passed in r31/r30.
 void flash_write(uint16_t addr);
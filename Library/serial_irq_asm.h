@@ -0,0 +1,27 @@
+// serial_irq_asm.h
+// C declarations for the assembly routines in serial_irq.S
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Initialise TX/RX pins, start Timer0 and the RX start-bit detector.
+// Owns Timer0, PCINT0 and both compare interrupts. Enables interrupts.
+// Must be called before serial_put, serial_get or serial_available.
+void init_serial_irq(void);
+
+// Queue one byte for transmit at SOFT_BAUD-8-N-1, without waiting.
+// Returns 1 if queued, 0 if the TX ring is full.
+uint8_t serial_put(uint8_t c);
+
+// Return the oldest received byte (0-255), or -1 if none is waiting.
+int16_t serial_get(void);
+
+// Return the number of received bytes waiting to be read.
+uint8_t serial_available(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+// serial_port_asm.h
+// C declarations for ports generated by SERIAL_PORT (serial_port.S)
+#pragma once
+#include <stdint.h>
+
+// SERIAL_PORT_DECLARE(bt) declares bt_init, bt_write and bt_read for the
+// port made by "SERIAL_PORT bt, tx, rx, baud" in an assembly file.
+//   name_init()    TX/RX pin setup and TRIM, before the first write/read
+//   name_write(c)  transmit one byte, 8-N-1
+//   name_read()    block until one byte is received, return it
+#ifdef __cplusplus
+#define SERIAL_PORT_LINKAGE extern "C"
+#else
+#define SERIAL_PORT_LINKAGE
+#endif
+
+#define SERIAL_PORT_DECLARE(name)                           \
+    SERIAL_PORT_LINKAGE void    name##_init(void);          \
+    SERIAL_PORT_LINKAGE void    name##_write(uint8_t c);    \
+    SERIAL_PORT_LINKAGE uint8_t name##_read(void)
@@ -0,0 +1,52 @@
+// softpwm_asm.h
+// C declarations for the assembly routines in softpwm.S
+// The SOFTPWM_ timer settings below are shared with softpwm.S, so this
+// file is also included from assembly.
+#pragma once
+
+// Timer0 prescaler, one PWM period is 256 timer counts: 586 Hz at 1.2 MHz
+// (/8) and 9.6 MHz (/64). A count must leave time for the edge ISR, so
+// keep it at 8 CPU cycles or more.
+#ifndef F_CPU_HZ
+#define F_CPU_HZ            1200000
+#endif
+#ifndef SOFTPWM_PRESCALE
+#if F_CPU_HZ <= 2400000
+#define SOFTPWM_PRESCALE    8
+#else
+#define SOFTPWM_PRESCALE    64
+#endif
+#endif
+#if SOFTPWM_PRESCALE == 8
+#define SOFTPWM_CS          (1<<CS01)
+#elif SOFTPWM_PRESCALE == 64
+#define SOFTPWM_CS          ((1<<CS01) | (1<<CS00))
+#else
+#define SOFTPWM_CS          (1<<CS02)
+#endif
+
+// channels, one per pin PB0-PB4
+#define SOFTPWM_CHANNELS    5
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Take over Timer0 (normal mode, overflow and compare A interrupts) and
+// drive the PORTB pins in mask (bits 0-4) as outputs, all off. Enables
+// global interrupts. Don't link with sysclock.S, which uses Timer0 too;
+// wdtclock.S can keep ticks() instead (call init_wdtclock first).
+void softpwm_init(uint8_t pins);
+
+// New duties for all channels, duty[n] for PBn, 0 (off) to 255 (on);
+// pins not given to softpwm_init are left alone. The edges are sorted
+// here and take effect together at the next PWM period.
+void softpwm_write(const uint8_t duty[SOFTPWM_CHANNELS]);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -1,6 +1,156 @@
 // sysclock_asm.h
 // C declarations for the assembly routines in sysclock.S
+// The SYSCLOCK_ timer settings below are shared with sysclock.S, so this
+// file is also included from assembly.
 #pragma once
+
+// Timer0 prescaler and CTC top for a 1 kHz tick, derived from F_CPU_HZ
+// (Makefile): the smallest prescaler that fits 1 ms in 8 bits.
+// 1.2 MHz: /8, 150 counts; 9.6 MHz: /64, 150 counts.
+#ifndef F_CPU_HZ
+#define F_CPU_HZ            1200000
+#endif
+#if F_CPU_HZ <= 256000
+#define SYSCLOCK_PRESCALE   1
+#define SYSCLOCK_CS         (1<<CS00)
+#elif F_CPU_HZ <= 2048000
+#define SYSCLOCK_PRESCALE   8
+#define SYSCLOCK_CS         (1<<CS01)
+#elif F_CPU_HZ <= 16384000
+#define SYSCLOCK_PRESCALE   64
+#define SYSCLOCK_CS         ((1<<CS01) | (1<<CS00))
+#else
+#define SYSCLOCK_PRESCALE   256
+#define SYSCLOCK_CS         (1<<CS02)
+#endif
+// A tick is SYSCLOCK_TOP + 1 + SYSCLOCK_FRAC/256 timer counts: OCR0A is
+// SYSCLOCK_TOP, and the ISR stretches a tick by one count often enough to
+// make up the fraction. Trim a chip with -DSYSCLOCK_TOP=n -DSYSCLOCK_FRAC=f
+// (docs/sysclock.md), FRAC is 0 unless given or F_CPU needs it.
+#ifndef SYSCLOCK_TOP
+#define SYSCLOCK_TOP        ((F_CPU_HZ / SYSCLOCK_PRESCALE) / 1000 - 1)
+#ifndef SYSCLOCK_FRAC
+#define SYSCLOCK_FRAC       ((F_CPU_HZ / SYSCLOCK_PRESCALE) % 1000 * 256 / 1000)
+#endif
+#endif
+#ifndef SYSCLOCK_FRAC
+#define SYSCLOCK_FRAC       0
+#endif
+// -DSYSCLOCK_TICKLESS=1 assembles sysclock_idle(): while the deadline is
+// far off, Timer0 runs SYSCLOCK_IDLE_STEP times slower with the same OCR0A,
+// so each compare interrupt stands for that many ticks.
+#ifndef SYSCLOCK_TICKLESS
+#define SYSCLOCK_TICKLESS   0
+#endif
+#if SYSCLOCK_PRESCALE == 1
+#define SYSCLOCK_IDLE_CS    ((1<<CS01) | (1<<CS00))
+#define SYSCLOCK_IDLE_STEP  64
+#elif SYSCLOCK_PRESCALE == 8
+#define SYSCLOCK_IDLE_CS    (1<<CS02)
+#define SYSCLOCK_IDLE_STEP  32
+#else
+#define SYSCLOCK_IDLE_CS    ((1<<CS02) | (1<<CS00))
+#define SYSCLOCK_IDLE_STEP  (1024 / SYSCLOCK_PRESCALE)
+#endif
+// -DSYSCLOCK_PWM=1: Timer0 runs fast PWM with OC0A/OC0B duty outputs
+// (pwm_set_a/b) and the overflow interrupt keeps the millisecond ticks.
+// Every overflow is SYSCLOCK_PWM_CYCLES CPU cycles; an accumulator turns
+// them into whole ms of SYSCLOCK_CPMS cycles. The default prescaler is the
+// tick's own: 586 Hz PWM and an interrupt every 1.7 ms at 1.2 and 9.6 MHz.
+#ifndef SYSCLOCK_PWM
+#define SYSCLOCK_PWM        0
+#endif
+#ifndef SYSCLOCK_PWM_PRESCALE
+#define SYSCLOCK_PWM_PRESCALE   SYSCLOCK_PRESCALE
+#endif
+#if SYSCLOCK_PWM_PRESCALE == 1
+#define SYSCLOCK_PWM_CS     (1<<CS00)
+#elif SYSCLOCK_PWM_PRESCALE == 8
+#define SYSCLOCK_PWM_CS     (1<<CS01)
+#else
+#define SYSCLOCK_PWM_CS     ((1<<CS01) | (1<<CS00))
+#endif
+// -DSYSCLOCK_FADE=1 (with SYSCLOCK_PWM): the overflow interrupt calls
+// fade_tick (fade.S) every tick to move the OC0A/OC0B brightness ramps.
+#ifndef SYSCLOCK_FADE
+#define SYSCLOCK_FADE       0
+#endif
+#define SYSCLOCK_PWM_CYCLES (256 * SYSCLOCK_PWM_PRESCALE)
+#define SYSCLOCK_CPMS       ((F_CPU_HZ + 500) / 1000)
+// -DSYSCLOCK_FAST=1: a second, faster periodic callback on compare B,
+// every n timer counts of the running tick counter (sysclock_fast_start).
+// The ISR saves what a C function may clobber; with -DSYSCLOCK_FAST_ASM=1
+// it saves only SREG and Z, and the callback must keep everything else.
+#ifndef SYSCLOCK_FAST
+#define SYSCLOCK_FAST       0
+#endif
+#ifndef SYSCLOCK_FAST_ASM
+#define SYSCLOCK_FAST_ASM   0
+#endif
+// timer counts in us microseconds, for sysclock_fast_start
+#define SYSCLOCK_COUNTS(us) (((us) * (SYSCLOCK_TOP + 1) + 500) / 1000)
+// -DSYSCLOCK_CLKDIV=1 assembles clock_set_div(): the CPU clock is
+// SYSCLOCK_OSC_HZ >> n (CLKPR, n 0-8), and the prescaler, TOP and FRAC of
+// the tick come from a flash table, one entry per n. F_CPU_HZ is the clock
+// at SYSCLOCK_DIV_BUILD, the one the soft serial delays are assembled for.
+#ifndef SYSCLOCK_CLKDIV
+#define SYSCLOCK_CLKDIV     0
+#endif
+#ifndef SYSCLOCK_OSC_HZ
+#define SYSCLOCK_OSC_HZ     9600000
+#endif
+#if F_CPU_HZ == SYSCLOCK_OSC_HZ
+#define SYSCLOCK_DIV_BUILD  0
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 2
+#define SYSCLOCK_DIV_BUILD  1
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 4
+#define SYSCLOCK_DIV_BUILD  2
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 8
+#define SYSCLOCK_DIV_BUILD  3
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 16
+#define SYSCLOCK_DIV_BUILD  4
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 32
+#define SYSCLOCK_DIV_BUILD  5
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 64
+#define SYSCLOCK_DIV_BUILD  6
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 128
+#define SYSCLOCK_DIV_BUILD  7
+#elif F_CPU_HZ == SYSCLOCK_OSC_HZ / 256
+#define SYSCLOCK_DIV_BUILD  8
+#else
+#define SYSCLOCK_DIV_BUILD  (-1)
+#endif
+// The CLKDIV tick interrupt is ~35 cycles. A divider must leave at least
+// twice that per ms, or the main program starves and matches are missed:
+// SYSCLOCK_DIV_MAX is the largest n that does, 7 (75 kHz) for 9.6 MHz.
+#define SYSCLOCK_CLKDIV_ISR 35
+#define SYSCLOCK_DIV_HZ_MIN (2 * SYSCLOCK_CLKDIV_ISR * 1000)
+#if (SYSCLOCK_OSC_HZ >> 8) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    8
+#elif (SYSCLOCK_OSC_HZ >> 7) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    7
+#elif (SYSCLOCK_OSC_HZ >> 6) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    6
+#elif (SYSCLOCK_OSC_HZ >> 5) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    5
+#elif (SYSCLOCK_OSC_HZ >> 4) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    4
+#elif (SYSCLOCK_OSC_HZ >> 3) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    3
+#elif (SYSCLOCK_OSC_HZ >> 2) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    2
+#elif (SYSCLOCK_OSC_HZ >> 1) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    1
+#elif (SYSCLOCK_OSC_HZ >> 0) >= SYSCLOCK_DIV_HZ_MIN
+#define SYSCLOCK_DIV_MAX    0
+#else
+#define SYSCLOCK_DIV_MAX    (-1)
+#endif
+// microseconds per timer count, 8.8 fixed point, for micros()
+// (no UL suffix, the assembler reads this too; 256000 is a long in C)
+#define SYSCLOCK_US_FP8     ((256000 + (SYSCLOCK_TOP + 1) / 2) / (SYSCLOCK_TOP + 1))
+
+#ifndef __ASSEMBLER__
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -13,6 +163,43 @@ void init_sysclock_1k(void);
 // Return the current 16-bit tick counter (incremented once per millisecond).
 uint16_t ticks(void);
 
+// Return microseconds: ticks * 1000 plus the Timer0 count within the tick.
+// Wraps every 65.536 ms; subtract two readings as uint16_t for intervals.
+// Resolution is one timer count (6.7 us at 1.2 MHz and 9.6 MHz).
+// Not available with SYSCLOCK_PWM or SYSCLOCK_CLKDIV.
+uint16_t micros(void);
+
+// Sleep (idle mode) until ticks() reaches until, or return at once if it
+// already has. Far from until the compare interrupt only comes every
+// SYSCLOCK_IDLE_STEP ticks and ticks() moves in steps of that size, which
+// other interrupt handlers see (micros() is not valid for them either);
+// they run as usual and sysclock_idle goes back to sleep. Returns with
+// ticks() == until, interrupts on. Only assembled with -DSYSCLOCK_TICKLESS=1.
+void sysclock_idle(uint16_t until);
+
+// Call fn from the compare B interrupt every counts timer counts (2 to
+// SYSCLOCK_TOP, see SYSCLOCK_COUNTS), the first one counts from now.
+// Replaces a running callback. fn must return well within the interval.
+// Only assembled with -DSYSCLOCK_FAST=1.
+void sysclock_fast_start(void (*fn)(void), uint8_t counts);
+
+// Stop the compare B callback.
+void sysclock_fast_stop(void);
+
+// Switch the CPU clock to SYSCLOCK_OSC_HZ >> n (n 0 to SYSCLOCK_DIV_MAX,
+// larger is taken as SYSCLOCK_DIV_MAX) and retime Timer0 so ticks() keeps counting milliseconds; the tick
+// in progress is scaled, not restarted. Returns the previous n. The soft
+// serial routines switch to SYSCLOCK_DIV_BUILD for each character and back.
+// Only assembled with -DSYSCLOCK_CLKDIV=1.
+uint8_t clock_set_div(uint8_t n);
+
+// Set the duty of OC0A (PB0) / OC0B (PB1), 0 (pin low) to 255 (pin high),
+// and make the pin an output. The new duty starts with the next PWM cycle.
+// OC0B is the soft serial RX pin. Only assembled with -DSYSCLOCK_PWM=1.
+void pwm_set_a(uint8_t duty);
+void pwm_set_b(uint8_t duty);
+
 #ifdef __cplusplus
 }
 #endif
+#endif
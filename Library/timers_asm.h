@@ -0,0 +1,47 @@
+// timers_asm.h
+// C declarations for the assembly routines in timers.S
+// TIMER_MAX is shared with timers.S, so this file is also included from
+// assembly. Set it in the example's Makefile (CPPFLAGS += -DTIMER_MAX=6).
+#pragma once
+
+// timers in the table, ids 0 to TIMER_MAX - 1, 3 bytes of SRAM each
+#ifndef TIMER_MAX
+#define TIMER_MAX       4
+#endif
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One table entry, in flash, TIMER_MAX of them indexed by timer id:
+//   const struct timer timers[TIMER_MAX] PROGMEM = { { blink, 500 }, ... };
+// A period of 0 makes a one-shot timer, otherwise fn runs every period
+// ticks (up to 32767) after the first delay.
+struct timer {
+    void (*fn)(void);
+    uint16_t period;
+};
+
+// Use the flash table with all timers stopped. init_sysclock_1k must be
+// running.
+void timer_init(const struct timer *table);
+
+// Call timer id's function delay ticks (1 to 32767) from now, restarting
+// it if it is already armed.
+void timer_start(uint8_t id, uint16_t delay);
+
+// Cancel timer id; does nothing if it isn't armed.
+void timer_stop(uint8_t id);
+
+// Call the functions of the timers that are due. Call it from the main
+// loop at least once a tick for 1 ms accuracy.
+void timer_poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,47 @@
+// wdtclock_asm.h
+// C declarations for the assembly routines in wdtclock.S
+// Also included from assembly for WDTCLOCK_SCALE. ticks() is declared in
+// sysclock_asm.h, which wdtclock.S stands in for: link one or the other.
+#pragma once
+#include "sysclock_asm.h"
+
+// init_wdtclock periods, 16 ms << n on the nominal 128 kHz WDT oscillator
+#define WDTCLOCK_16MS       0
+#define WDTCLOCK_32MS       1
+#define WDTCLOCK_64MS       2
+#define WDTCLOCK_125MS      3
+#define WDTCLOCK_250MS      4
+#define WDTCLOCK_500MS      5
+#define WDTCLOCK_1S         6
+#define WDTCLOCK_2S         7
+#define WDTCLOCK_4S         8
+#define WDTCLOCK_8S         9
+
+// Timer0 counts at SYSCLOCK_CS to 1/256 ms, times 256:
+// 256 * 256000 / (F_CPU_HZ / SYSCLOCK_PRESCALE), rounded
+#define WDTCLOCK_SCALE      ((65536000 + F_CPU_HZ / SYSCLOCK_PRESCALE / 2) / (F_CPU_HZ / SYSCLOCK_PRESCALE))
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Measure the WDT oscillator against the CPU clock with Timer0, then count
+// ticks() in milliseconds from a WDT interrupt every period (WDTCLOCK_16MS
+// to WDTCLOCK_8S). ticks() advances by the measured period length at each
+// interrupt. Timer0 is stopped afterwards: set up PWM after this call.
+// Takes up to 32 ms. Enables global interrupts.
+void init_wdtclock(uint8_t period);
+
+// Power down until ticks() reaches until. Every WDT interrupt (and any other
+// enabled interrupt that can wake power-down) wakes the CPU to check.
+// Timer0 and its PWM stop while asleep; to keep PWM running, sleep in idle
+// mode instead (avr/sleep.h).
+void wdtclock_sleep(uint16_t until);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
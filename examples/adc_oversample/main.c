@@ -0,0 +1,43 @@
+// adc_oversample - a pot on PB4 read to 12 bits with Library/adc.S
+// Lights one of three LEDs by the pot's position, as read_POTi does, but
+// the ADC interrupt sums 16 conversions into each 12-bit result and main
+// reads it with no ATOMIC_BLOCK. The LEDs only change when adc_seq says
+// a new result is in, and the band edges have a little hysteresis so a
+// pot resting on one doesn't flicker between two LEDs.
+
+#include <avr/io.h>
+#include "adc_asm.h"
+
+#define GREEN PB0
+#define YELLOW PB1
+#define BLUE PB2
+
+#define FULL (1 << ADC_BITS)
+#define TOP (FULL * 2 / 3)
+#define MID (FULL / 3)
+#define HYST 16                             // 12-bit counts
+
+int main(void)
+{
+    uint8_t seen = 0;
+    uint8_t led = GREEN;
+
+    DDRB |= (_BV(GREEN) | _BV(YELLOW) | _BV(BLUE));
+    adc_init(ADC_PB4);
+
+    for (;;)
+    {
+        if (adc_seq() == seen)
+            continue;
+        seen = adc_seq();
+        uint16_t result = adc_read();
+
+        if (result > TOP + (led == BLUE ? -HYST : HYST))
+            led = BLUE;
+        else if (result > MID + (led == GREEN ? HYST : -HYST))
+            led = YELLOW;
+        else
+            led = GREEN;
+        PORTB = (PORTB & ~(_BV(GREEN) | _BV(YELLOW) | _BV(BLUE))) | _BV(led);
+    }
+}
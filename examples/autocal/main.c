@@ -0,0 +1,26 @@
+// autocal - init_serial tunes OSCCAL from host 0x55 ('U') sync bytes
+// See Makefile for the SERIAL_AUTOCAL flags, use make complete after
+// changing them so Library/serial.o is rebuilt.
+//
+// First boot (EEPROM byte 63 erased): from the host, before reset,
+//   stty -F /dev/ttyUSB0 9600 raw
+//   while :; do printf U > /dev/ttyUSB0; sleep 0.05; done
+// The chip measures 6 sync bytes, stores OSCCAL in EEPROM and prints it.
+// Later boots load the EEPROM value and need no host.
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "serial_asm.h"
+#include "printf_asm.h"
+
+int main(void)
+{
+    init_serial();
+
+    flash_printf(PSTR("\r\nOSCCAL=%x\r\n"), OSCCAL);
+
+    // Echo each received character back over the serial port.
+    for (;;) {
+        char_write(char_read());
+    }
+}
@@ -0,0 +1,29 @@
+// bam - five LEDs dimmed on PB0-PB4 with binary code modulation (Library/bam.S)
+// The same ramps as examples/softpwm, but the interrupt load doesn't
+// depend on the duties: 5 compare interrupts per 294 Hz frame, whether
+// one LED is lit or five at five different levels.
+
+#include <avr/io.h>
+#include <util/delay.h>
+#include "bam_asm.h"
+
+#define STEP_MS 4       // ms per brightness step
+
+int main(void)
+{
+    uint8_t duty[BAM_CHANNELS];
+    uint8_t phase = 0;
+
+    bam_init(0x1F);                         // PB0-PB4
+
+    while (1)
+    {
+        for (uint8_t i = 0; i < BAM_CHANNELS; i++) {
+            uint8_t p = phase + i * 51;     // spread over the ramp
+            duty[i] = (p & 0x80) ? (uint8_t)(~p << 1) : (uint8_t)(p << 1);
+        }
+        bam_write(duty);
+        phase++;
+        _delay_ms(STEP_MS);
+    }
+}
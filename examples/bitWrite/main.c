@@ -1,12 +1,15 @@
 // bitWrite - use serial port to control value on pins PB0-PB2
 // Change serial pins and timing in Library/registers.S and Library/serial.S
+// Reads time out, so an idle or unplugged cable just re-sends the prompt.
 
 #include <avr/pgmspace.h>
 #include <avr/io.h>
 #include "serial_asm.h"
+#include "sysclock_asm.h"
 
 #define CR 13
 #define LF 10
+#define PROMPT_MS 5000
 
 const char prompt[]  PROGMEM = "A";
 const char waiting[] PROGMEM = "?";
@@ -23,6 +26,8 @@ int main(void)
     /* set pin to output*/
     DDRB |= (_BV(PORTB2) | _BV(PORTB1) | _BV(PORTB0));
 
+    init_sysclock_1k();
+    TCCR0A &= ~_BV(COM0A0);     // PB0 is a bit here, not the OC0A tick toggle
     init_serial();
 
     char_write(CR);
@@ -34,7 +39,16 @@ int main(void)
 
     // Echo each received character back over the serial port.
     for (;;) {
-        uint8_t bits = char_read();
+        int16_t c = char_read_timeout(PROMPT_MS);
+        if (c == SERIAL_TIMEOUT)
+        {
+            pgmtext_write(waiting);
+            continue;
+        }
+        if (c == SERIAL_FRAME_ERR)
+            continue;
+
+        uint8_t bits = c;
         char_write(bits);
 
         bits -= 0x30;
@@ -0,0 +1,55 @@
+// bridge - relay between the host serial port and an HC-06 Bluetooth module
+// Two soft serial ports on one chip, generated in ports.S by SERIAL_PORT.
+// Type AT commands in a terminal on the host (see docs/bluetooth.md) or
+// talk to the Pi over rfcomm; each side sees what the other sends.
+//
+// Ports block, so bytes are gathered into a short burst on one side until
+// the line goes idle, then sent on the other. Bursts longer than BURST
+// bytes lose characters.
+
+#include <avr/io.h>
+#include "serial_port_asm.h"
+
+SERIAL_PORT_DECLARE(host);
+SERIAL_PORT_DECLARE(bt);
+
+#define HOST_RX PB1
+#define BT_RX   PB4
+#define BURST   16
+// Idle polls that end a burst, about 2 characters at 9600 baud and 1.2 MHz
+#define IDLE_POLLS 250
+
+static uint8_t buf[BURST];
+
+// Read bytes until the rx pin stays high for IDLE_POLLS or buf is full
+static uint8_t gather(uint8_t (*read)(void), uint8_t rx)
+{
+    uint8_t n = 0;
+    uint8_t idle;
+
+    do {
+        buf[n++] = read();
+        for (idle = IDLE_POLLS; idle && (PINB & _BV(rx)); idle--)
+            ;
+    } while (idle && n < BURST);
+    return n;
+}
+
+static void relay(uint8_t n, void (*write)(uint8_t))
+{
+    for (uint8_t i = 0; i < n; i++)
+        write(buf[i]);
+}
+
+int main(void)
+{
+    host_init();
+    bt_init();
+
+    for (;;) {
+        if (!(PINB & _BV(HOST_RX)))
+            relay(gather(host_read, HOST_RX), bt_write);
+        if (!(PINB & _BV(BT_RX)))
+            relay(gather(bt_read, BT_RX), host_write);
+    }
+}
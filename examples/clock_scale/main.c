@@ -0,0 +1,55 @@
+// clock_scale - run the CPU from 9.6 MHz down to 75 kHz with clock_set_div
+// Every 2 s the CLKPR divider steps on, from 0 to SYSCLOCK_DIV_MAX and
+// round again, and the new divider and ticks() are printed on the soft
+// serial port:
+//   div 4 ticks 8000
+// SYSCLOCK_DIV_MAX is 7 for the 9.6 MHz oscillator: at 37.5 kHz the tick
+// interrupt would leave the program next to no time. The LED on PB3
+// toggles every 500 ms at each of these clocks, as ticks() is retimed
+// with each switch. The serial output itself runs at the build
+// clock (F_CPU), serial.S switches to it for each character.
+// PB0 carries the sysclock OC0A square wave, which keeps 500 Hz too.
+
+#include <avr/io.h>
+#include "serial_asm.h"
+#include "sysclock_asm.h"
+#include "format_asm.h"
+
+#define LED3 3          // LED to pin 3
+
+static void print(const char *s)
+{
+    while (*s)
+        char_write(*s++);
+}
+
+int main(void)
+{
+    init_sysclock_1k();
+    init_serial();
+    DDRB |= _BV(LED3);
+
+    uint8_t div = SYSCLOCK_DIV_BUILD;
+    uint16_t blink = ticks();
+    uint16_t step = blink;
+
+    while (1)
+    {
+        uint16_t now = ticks();
+        if ((uint16_t)(now - blink) >= 500) {
+            blink += 500;
+            PINB = _BV(LED3);               // toggle
+        }
+        if ((uint16_t)(now - step) >= 2000) {
+            step += 2000;
+            div = (div + 1) % (SYSCLOCK_DIV_MAX + 1);
+            clock_set_div(div);
+            print("div ");
+            put_u8(div);
+            print(" ticks ");
+            put_u16(ticks());
+            char_write('\r');
+            char_write('\n');
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// dds_tone - sine tones on OC0A (PB0) with Library/dds.S
+// Built with -DDDS_VOICES=2 (Makefile). A piezo or a small speaker
+// through a capacitor on PB0 plays an alert: a two-tone warble, then the
+// two tones together as a chord, then a pause. The Timer0 overflow
+// interrupt makes every sample, so the pitch holds while the main loop
+// waits; the waits use ticks() from wdtclock.S, since dds.S owns Timer0.
+// Compare with fast_tone, which toggles a pin for a square wave.
+
+#include <avr/io.h>
+#include "wdtclock_asm.h"
+#include "dds_asm.h"
+
+#define TONE_HI DDS_STEP(880)
+#define TONE_LO DDS_STEP(660)
+
+#define WARBLE_MS 250
+#define CHORD_MS 1000
+#define PAUSE_MS 1000
+
+static void wait(uint16_t ms)
+{
+    uint16_t start = ticks();
+    while ((uint16_t)(ticks() - start) < ms)
+        ;
+}
+
+int main(void)
+{
+    init_wdtclock(WDTCLOCK_16MS);           // before dds_init: uses Timer0
+
+    while (1)
+    {
+        dds_init();
+        for (uint8_t i = 0; i < 4; i++) {
+            dds_set(0, TONE_HI);
+            wait(WARBLE_MS);
+            dds_set(0, TONE_LO);
+            wait(WARBLE_MS);
+        }
+        dds_set(0, TONE_HI);
+        dds_set(1, TONE_LO);
+        wait(CHORD_MS);
+        dds_stop();                         // no 4.7 kHz carrier in the pause
+        wait(PAUSE_MS);
+    }
+}
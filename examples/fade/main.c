@@ -0,0 +1,41 @@
+// fade - two LEDs breathing on OC0A (PB0) and OC0B (PB1) with Library/fade.S
+// Built with -DSYSCLOCK_PWM=1 -DSYSCLOCK_FADE=1 (Makefile): the sysclock
+// overflow interrupt moves the ramps, so main only starts a new one when
+// the last has finished. The levels go through a gamma table, so the
+// LEDs look like they brighten and dim evenly. A third LED on PB3 blinks
+// once a second to show the main loop is free. Compare with pwm_sysclock,
+// which steps a linear fade from the main loop.
+
+#include <avr/io.h>
+#include "sysclock_asm.h"
+#include "fade_asm.h"
+
+#define BLINK PB3
+
+#define BREATH_MS 1500  // ms for each rise or fall
+#define BLINK_INTERVAL 500
+
+int main(void)
+{
+    uint16_t blink_ticks = 0;
+    uint8_t up = 1;
+
+    init_sysclock_1k();
+    DDRB |= _BV(BLINK);
+
+    while (1)
+    {
+        if (!fade_busy())
+        {
+            fade_to(0, up ? 255 : 0, BREATH_MS);
+            fade_to(1, up ? 0 : 255, BREATH_MS);
+            up = !up;
+        }
+
+        if ((uint16_t)(ticks() - blink_ticks) >= BLINK_INTERVAL)
+        {
+            blink_ticks += BLINK_INTERVAL;
+            PINB = _BV(BLINK);                  // toggle
+        }
+    }
+}
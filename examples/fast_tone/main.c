@@ -0,0 +1,45 @@
+// fast_tone - a hardware paced 4 kHz callback next to the 1 ms ticks
+// Built with -DSYSCLOCK_FAST=1 (Makefile): sysclock_fast_start runs
+// toggle() from the Timer0 compare B interrupt every 250 us, so a piezo
+// or small speaker on PB4 gets a steady 2 kHz tone. The main loop beeps
+// it on and off every 500 ms with ticks(). The tone stays clean however
+// busy the main loop is, since the interrupt, not the loop, sets the
+// spacing.
+
+#include <avr/io.h>
+#include "sysclock_asm.h"
+
+#define SPEAKER PB4
+
+#define HALF_PERIOD_US 250
+#define BEEP_INTERVAL 500
+
+static void toggle(void)
+{
+    PINB = _BV(SPEAKER);
+}
+
+int main(void)
+{
+    uint16_t beep_ticks = 0;
+    uint8_t on = 0;
+
+    init_sysclock_1k();
+    DDRB |= _BV(SPEAKER);
+
+    while (1)
+    {
+        if ((uint16_t)(ticks() - beep_ticks) >= BEEP_INTERVAL)
+        {
+            beep_ticks += BEEP_INTERVAL;
+            on = !on;
+            if (on)
+                sysclock_fast_start(toggle, SYSCLOCK_COUNTS(HALF_PERIOD_US));
+            else
+            {
+                sysclock_fast_stop();
+                PORTB &= ~_BV(SPEAKER);
+            }
+        }
+    }
+}
@@ -11,32 +11,11 @@
 #include <avr/pgmspace.h>
 #include <util/delay.h>
 #include "serial_asm.h"
-
-static const char chip[] PROGMEM = "chip ";
-static const char osccal_label[] PROGMEM = "OSCCAL=";
-static const char sep[]          PROGMEM = ": ";
-static const char pattern[]      PROGMEM = "ABC123\r\n";
-
-static void pgmtext_write(const char *p)
-{
-    for (uint8_t c; (c = pgm_read_byte(p)); p++)
-        char_write(c);
-}
-
-static void send_hex_byte(uint8_t value)
-{
-    uint8_t high = (value >> 4) & 0x0F;
-    uint8_t low  = value & 0x0F;
-    char_write(high < 10 ? '0' + high : 'A' + high - 10);
-    char_write(low  < 10 ? '0' + low  : 'A' + low  - 10);
-}
+#include "printf_asm.h"
 
 static void emit_line(void)
 {
-    pgmtext_write(osccal_label);
-    send_hex_byte(OSCCAL);
-    pgmtext_write(sep);
-    pgmtext_write(pattern);
+    flash_printf(PSTR("OSCCAL=%x: ABC123\r\n"), OSCCAL);
 }
 
 int main(void)
@@ -45,11 +24,7 @@ int main(void)
 
     // print OSCCAL value currently on chip for reference
     // start with a low OSCCAL to ensure low values are checked
-    pgmtext_write(chip);
-    pgmtext_write(osccal_label);
-    send_hex_byte(OSCCAL);
-    char_write('\r'); 
-    char_write('\n');
+    flash_printf(PSTR("chip OSCCAL=%x\r\n"), OSCCAL);
     uint8_t osccal_start = 0x55;
 
     while (1)
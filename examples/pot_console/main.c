@@ -0,0 +1,68 @@
+// pot_console - read_POTi's three LEDs plus a serial console on one pin
+// Serial is half duplex on PB3 (SERIAL_ONEWIRE, see Makefile and
+// docs/softserial.md for the diode wiring), so PB0-PB2 drive the LEDs and
+// PB4 reads the pot. Every reading is printed, any key toggles printing.
+// Use make complete after changing the Makefile flags (Library/serial.o).
+// The ADC is polled: an ISR firing mid-frame would skew the serial timing.
+
+#include <avr/io.h>
+#include "serial_asm.h"
+#include "format_asm.h"
+
+#define GREEN PB0
+#define YELLOW PB1
+#define BLUE PB2
+#define SERIAL PB3
+#define POT PB4
+
+#define TOP 682
+#define MID 341
+
+static inline void initADC2(void)
+{
+    ADMUX = _BV(MUX1);                      // ADC2 (PB4), VCC as reference
+    ADCSRA = _BV(ADEN) | _BV(ADPS2);        // enable, /16 prescaler
+}
+
+static uint16_t read_ADC(void)
+{
+    ADCSRA |= _BV(ADSC);                    // start ADC conversion
+    loop_until_bit_is_clear(ADCSRA, ADSC);  // wait until done
+    return ADC;
+}
+
+int main(void)
+{
+    uint8_t printing = 1;
+
+    init_serial();
+    initADC2();
+    DDRB |= (_BV(GREEN) | _BV(YELLOW) | _BV(BLUE));
+    DDRB &= ~_BV(POT);
+
+    for (;;)
+    {
+        uint16_t result = read_ADC();
+        uint8_t led = result > TOP ? BLUE : result > MID ? YELLOW : GREEN;
+
+        PORTB = (PORTB & ~(_BV(GREEN) | _BV(YELLOW) | _BV(BLUE))) | _BV(led);
+
+        if (printing)
+        {
+            put_u16w(result, 4);
+            char_write('\r');
+            char_write('\n');
+        }
+
+        // the line idles high, a start bit means the host sent a key;
+        // poll it tightly for a while so the start bit isn't missed
+        for (uint16_t i = 0; i < 20000; i++)
+        {
+            if (bit_is_clear(PINB, SERIAL))
+            {
+                char_read();
+                printing = !printing;
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// protothreads - celebrate and button_timed, rewritten to run together
+// Two blocking loops become protothreads (Library/pt.h) sharing the main
+// loop: chase() walks three LEDs like blink() in celebrate, and button()
+// debounces and times presses like press_time() in button_timed. A press
+// sets the chase speed to a quarter of its length. Neither one ever
+// blocks the other, with 3 bytes of SRAM per thread and no stack each.
+// PB0 carries the sysclock OC0A square wave, so the LEDs are on PB1-PB3.
+
+#include <avr/io.h>
+#include "sysclock_asm.h"
+#include "pt.h"
+
+#define RED PB1
+#define BLUE PB2
+#define GREEN PB3
+#define BUTTON PB4
+
+#define MIN_STEP 20     // fastest chase, ms per LED
+#define MAX_STEP 1000   // slowest
+
+static uint16_t step = 125;
+
+// chase - one LED at a time, step ms each
+static PT_THREAD(chase(struct pt *pt))
+{
+    PT_BEGIN(pt);
+    for (;;)
+    {
+        PORTB = (PORTB & ~_BV(GREEN)) | _BV(RED);
+        PT_WAIT_TICKS(pt, step);
+        PORTB = (PORTB & ~_BV(RED)) | _BV(BLUE);
+        PT_WAIT_TICKS(pt, step);
+        PORTB = (PORTB & ~_BV(BLUE)) | _BV(GREEN);
+        PT_WAIT_TICKS(pt, step);
+    }
+    PT_END(pt);
+}
+
+// button - 5 equal readings 1 ms apart to confirm a press and a release,
+// then set the chase speed from how long it was held
+static PT_THREAD(button(struct pt *pt))
+{
+    static uint8_t state = 0;
+    static uint16_t down;
+
+    PT_BEGIN(pt);
+    for (;;)
+    {
+        do
+        {
+            // shift in the current reading, 1 = down
+            state = (state << 1) | !(PINB & _BV(BUTTON)) | 0xE0;
+            PT_WAIT_TICKS(pt, 1);
+        } while (state != 0xFF);
+        down = ticks();
+
+        do
+        {
+            state = (state << 1) | !(PINB & _BV(BUTTON));
+            PT_WAIT_TICKS(pt, 1);
+        } while (state & 0x1F);
+
+        step = (ticks() - down) / 4;
+        if (step < MIN_STEP)
+            step = MIN_STEP;
+        if (step > MAX_STEP)
+            step = MAX_STEP;
+    }
+    PT_END(pt);
+}
+
+int main(void)
+{
+    static struct pt chase_pt, button_pt;
+
+    init_sysclock_1k();
+    DDRB |= (_BV(RED) | _BV(BLUE) | _BV(GREEN));
+    PORTB |= _BV(BUTTON);                   // input pullup
+
+    PT_INIT(&chase_pt);
+    PT_INIT(&button_pt);
+    while (1)
+    {
+        chase(&chase_pt);
+        button(&button_pt);
+    }
+}
@@ -0,0 +1,46 @@
+// pwm_sysclock - hardware PWM and the 1 ms ticks on Timer0 together
+// Built with -DSYSCLOCK_PWM=1 (Makefile): Timer0 runs fast PWM on OC0A
+// (PB0) and OC0B (PB1), and its overflow interrupt keeps ticks(). Two
+// LEDs cross-fade, one step every FADE_STEP ms timed with ticks(), while
+// a third on PB3 blinks once a second. Compare with blink_pwm, which
+// spends three interrupts per PWM cycle and times with _delay_ms.
+
+#include <avr/io.h>
+#include "sysclock_asm.h"
+
+#define BLINK PB3
+
+#define FADE_STEP 4     // ms per brightness step
+#define BLINK_INTERVAL 500
+
+int main(void)
+{
+    uint16_t fade_ticks = 0;
+    uint16_t blink_ticks = 0;
+    uint8_t level = 0;
+    int8_t dir = 1;
+
+    init_sysclock_1k();
+    DDRB |= _BV(BLINK);
+
+    while (1)
+    {
+        uint16_t now = ticks();
+
+        if ((uint16_t)(now - fade_ticks) >= FADE_STEP)
+        {
+            fade_ticks += FADE_STEP;
+            if ((level == 255 && dir > 0) || (level == 0 && dir < 0))
+                dir = -dir;
+            level += dir;
+            pwm_set_a(level);
+            pwm_set_b(255 - level);
+        }
+
+        if ((uint16_t)(now - blink_ticks) >= BLINK_INTERVAL)
+        {
+            blink_ticks += BLINK_INTERVAL;
+            PINB = _BV(BLINK);                  // toggle
+        }
+    }
+}
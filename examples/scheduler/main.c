@@ -0,0 +1,59 @@
+// scheduler - multitask_wo_delay with the task table in flash (Library/sched.S)
+// Two LEDs blink at their own rates, and every 5 s a report task prints
+// each task's skipped runs and worst lateness on the soft serial port:
+//   0:0/0 1:0/0 2:0/0
+// The report itself takes ~20 ms of serial output, so the blink tasks
+// show a few ticks of lateness when they fall due during it.
+// PB0 carries the sysclock OC0A square wave, so the LEDs are on PB3 and PB4.
+// Built tickless (Makefile), sched_run sleeps between deadlines and the
+// 1 kHz interrupt drops to one every 32 ms while waiting.
+
+#include <avr/io.h>
+#include "serial_asm.h"
+#include "sysclock_asm.h"
+#include "format_asm.h"
+#include "sched_asm.h"
+
+#define WHITE 3         // white LED to pin 3
+#define RED 4           // red LED to pin 4
+
+static void white(void)
+{
+    PINB = _BV(WHITE);                      // toggle
+}
+
+static void red(void)
+{
+    PINB = _BV(RED);
+}
+
+static void report(void)
+{
+    for (uint8_t i = 0; i < 3; i++) {
+        put_u8(i);
+        char_write(':');
+        put_u8(sched_state[i].overruns);
+        char_write('/');
+        put_u8(sched_state[i].max_late);
+        char_write(' ');
+    }
+    char_write('\r');
+    char_write('\n');
+}
+
+// function, period, phase (ticks)
+static const struct sched_task tasks[] PROGMEM = {
+    { white, 1000, 0 },
+    { red, 500, 125 },
+    { report, 5000, 2500 },
+};
+
+int main(void)
+{
+    init_sysclock_1k();
+    init_serial();
+    DDRB |= (_BV(WHITE) | _BV(RED));
+
+    sched_init(tasks, sizeof(tasks) / sizeof(tasks[0]));
+    sched_run();
+}
@@ -0,0 +1,42 @@
+// serial_irq - interrupt-driven serial echo, LED keeps blinking meanwhile
+// Serial pins in Library/registers.S, baud from SOFT_BAUD in env.make
+// Bytes are bit-banged from Timer0/PCINT0 interrupts (Library/serial_irq.S),
+// so the loop below never waits on a frame in flight.
+
+#include <avr/pgmspace.h>
+#include <avr/io.h>
+#include "serial_irq_asm.h"
+
+#define CR 13
+#define LF 10
+#define BLINK_PASSES 20000      // main loop passes per LED toggle
+
+const char prompt[] PROGMEM = "\r\n?";
+
+int main(void)
+{
+    uint16_t passes = 0;
+
+    DDRB |= _BV(PORTB0);            // LED on PB0
+    init_serial_irq();
+
+    // prompt fits in the TX ring, so no need to retry here
+    for (const char *p = prompt; pgm_read_byte(p); p++)
+        serial_put(pgm_read_byte(p));
+
+    for (;;) {
+        // echo whatever has arrived, a CR gets a LF to go with it
+        int16_t c = serial_get();
+        if (c >= 0) {
+            serial_put(c);
+            if (c == CR)
+                serial_put(LF);
+        }
+
+        // stands in for the real work: sampling, blinking, ...
+        if (++passes == BLINK_PASSES) {
+            passes = 0;
+            PINB = _BV(PINB0);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// softpwm - five LEDs dimmed at once on PB0-PB4 with Library/softpwm.S
+// Each LED ramps up and down with its own phase, so the five duties are
+// all different most of the time: six interrupts per PWM period. Compare
+// with blink_pwm, which has two channels and an interrupt for each.
+// The duties are written as a set, softpwm_write sorts them and they
+// start together with the next PWM period. After each full ramp all five
+// flash fully on (255, no edge) and then off (0), which the overflow has
+// to turn off by itself.
+
+#include <avr/io.h>
+#include <util/delay.h>
+#include "softpwm_asm.h"
+
+#define STEP_MS 4       // ms per brightness step
+#define FLASH_MS 200    // full on, then off, after each ramp
+
+static void write_all(uint8_t level)
+{
+    uint8_t duty[SOFTPWM_CHANNELS];
+
+    for (uint8_t i = 0; i < SOFTPWM_CHANNELS; i++)
+        duty[i] = level;
+    softpwm_write(duty);
+    _delay_ms(FLASH_MS);
+}
+
+int main(void)
+{
+    uint8_t duty[SOFTPWM_CHANNELS];
+    uint8_t phase = 0;
+
+    softpwm_init(0x1F);                     // PB0-PB4
+
+    while (1)
+    {
+        for (uint8_t i = 0; i < SOFTPWM_CHANNELS; i++) {
+            uint8_t p = phase + i * 51;     // spread over the ramp
+            duty[i] = (p & 0x80) ? (uint8_t)(~p << 1) : (uint8_t)(p << 1);
+        }
+        softpwm_write(duty);
+        _delay_ms(STEP_MS);
+        if (++phase == 0) {
+            write_all(255);
+            write_all(0);
+        }
+    }
+}
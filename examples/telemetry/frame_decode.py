@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+# frame_decode.py - host side decoder for Library/frame.S
+#
+# Reads COBS frames (payload + CRC-8/MAXIM, 0x00 delimited) from a serial
+# port and reports frames/s and the CRC error rate once a second.
+# Linux only (termios), no pyserial needed.
+#
+#   python3 frame_decode.py /dev/ttyUSB0 9600        # rates only
+#   python3 frame_decode.py /dev/ttyUSB0 9600 -v     # plus each payload
+#
+# The telemetry example payload is seq, ticks, adc; -v prints it decoded.
+
+import argparse
+import os
+import struct
+import sys
+import termios
+import time
+
+
+def crc8(data):
+    """CRC-8/MAXIM, poly 0x31 reflected (0x8C), init 0 - same as frame.S"""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8C if crc & 1 else crc >> 1
+    return crc
+
+
+def cobs_decode(frame):
+    """Decode one COBS frame (delimiter removed), None if malformed"""
+    out = bytearray()
+    i = 0
+    while i < len(frame):
+        code = frame[i]
+        if code == 0 or i + code > len(frame):
+            return None
+        out += frame[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def open_port(device, baud):
+    """Open device raw, 8-N-1 at baud"""
+    speed = getattr(termios, "B%d" % baud, None)
+    if speed is None:
+        sys.exit("unsupported baud rate: %d" % baud)
+    fd = os.open(device, os.O_RDONLY | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    attrs[0] = 0                                        # iflag
+    attrs[1] = 0                                        # oflag
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0                                        # lflag
+    attrs[4] = attrs[5] = speed
+    attrs[6][termios.VMIN] = 1
+    attrs[6][termios.VTIME] = 0
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    termios.tcflush(fd, termios.TCIFLUSH)
+    return fd
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode frame.S COBS + CRC8 frames")
+    parser.add_argument("device")
+    parser.add_argument("baud", type=int, nargs="?", default=9600)
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print every good payload")
+    args = parser.parse_args()
+
+    fd = open_port(args.device, args.baud)
+    buf = bytearray()
+    synced = False              # drop the partial frame we joined in
+    good = bad = 0
+    total_good = total_bad = 0
+    start = last = time.monotonic()
+
+    try:
+        while True:
+            buf += os.read(fd, 256)
+            while True:
+                end = buf.find(0)
+                if end < 0:
+                    break
+                raw, buf = bytes(buf[:end]), buf[end + 1:]
+                if not synced:
+                    synced = True
+                    continue
+                data = cobs_decode(raw)
+                if not data or crc8(data[:-1]) != data[-1]:
+                    bad += 1
+                    continue
+                good += 1
+                payload = data[:-1]
+                if args.verbose:
+                    if len(payload) == 5:
+                        seq, ticks, adc = struct.unpack("<BHH", payload)
+                        print("seq %3d  ticks %5d  adc %4d" % (seq, ticks, adc))
+                    else:
+                        print(payload.hex(" "))
+
+            now = time.monotonic()
+            if now - last >= 1.0:
+                total_good += good
+                total_bad += bad
+                frames = good + bad
+                rate = 100.0 * bad / frames if frames else 0.0
+                total = total_good + total_bad
+                total_rate = 100.0 * total_bad / total if total else 0.0
+                print("%7.1f s  %6.1f frames/s  crc errors %5.2f %%  "
+                      "(total %d frames, %.3f %%)"
+                      % (now - start, good / (now - last), rate,
+                         total, total_rate))
+                good = bad = 0
+                last = now
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.close(fd)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,42 @@
+// telemetry - stream ticks() and ADC samples as COBS + CRC8 frames
+// Each frame is 5 payload bytes: seq, ticks (lo, hi), ADC2 on PB4 (lo, hi)
+// Decode on the host with: python3 frame_decode.py /dev/ttyUSB0 9600
+// Any data value is safe, 0x00 only ever appears as the frame delimiter.
+
+#include <avr/io.h>
+#include "serial_asm.h"
+#include "sysclock_asm.h"
+#include "frame_asm.h"
+
+#define ADC_PIN 4
+
+struct sample {
+    uint8_t  seq;
+    uint16_t ticks;
+    uint16_t adc;
+};
+
+static inline void initADC2(void)
+{
+    ADMUX = _BV(MUX1);                      // ADC2 (PB4), VCC as reference
+    ADCSRA = _BV(ADEN) | _BV(ADPS2);        // enable, /16 prescaler
+}
+
+int main(void)
+{
+    struct sample s = { 0 };
+
+    init_sysclock_1k();
+    init_serial();
+    initADC2();
+    DDRB &= ~_BV(ADC_PIN);
+
+    for (;;) {
+        ADCSRA |= _BV(ADSC);                    // start ADC conversion
+        loop_until_bit_is_clear(ADCSRA, ADSC);  // wait until done
+        s.adc = ADC;
+        s.ticks = ticks();
+        frame_send((const uint8_t *)&s, sizeof(s));
+        s.seq++;
+    }
+}
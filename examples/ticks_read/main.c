@@ -1,6 +1,6 @@
 // ticks_read - demonstrate time counter w/ system clock
 // Sets up a system tick of 1 millisec (1kHz) using a CPU clock of 9.6MHz
-// CKDIV8 fuse needs to be set to 1
+// CKDIV8 fuse needs to be set to 1; the Makefile sets F_CPU = 9600000UL
 // Use: avrdude -c snap_isp -p attiny13a -U lfuse:w:0x7A:m -U hfuse:w:0xF7:m
 // To test, used DIgilent frequency measurement of 499Hz, 1.002ms tick width
  
@@ -10,6 +10,7 @@
 #include <util/atomic.h>
 #include <avr/interrupt.h>
 #include "ATtiny.h"
+#include "sysclock_asm.h"
 
 // ****Defined Interrupt Service Routines****
 volatile uint16_t ticks_ctr = 0;
@@ -30,20 +31,19 @@ void init_sysclock_1k (void)
     // This will require the Low Fuse bit 4 CKDIV8 to be set to 1
     // The values below will result in a 1kHz counter (1000 ticks = 1 second)
     // CTC mode (WGM0[2:0] = 2)
-    // Set clock select to /8 CS => 010
+    // Clock select SYSCLOCK_CS from Library/sysclock_asm.h, /64 at 9.6MHz
     // Bit 2 – OCIE0A: Timer/Counter0 Output Compare Match A Interrupt Enable
     // COM0A0 - set to view OC0A on PB0 with scope
-    // OCR0A = x91
+    // OCR0A = SYSCLOCK_TOP, trimmed to 145 (0x91) in the Makefile
 
     // TCCR0A [ COM0A1 COM0A0 COM0B1 COM0B0 0 0 WGM01 WGM00 ] = 0b01000010
-    // TCCR0B [ FOC0A FOC0B 0 0 WGM02 CS02 CS01 CS00 ] = 0b00000011
+    // TCCR0B [ FOC0A FOC0B 0 0 WGM02 CS02 CS01 CS00 ] = SYSCLOCK_CS
     // TIMSK0 [ 0 0 0 0  OCIE0B  OCIE0A  TOIE0 0 ] = 0b00000100
-    // OCR0A = 0x96
 
     TCCR0A = ( _BV(COM0A0) | _BV(WGM01) ) ; 
-    TCCR0B |= ( _BV(CS01) | _BV(CS00)) ;
+    TCCR0B |= SYSCLOCK_CS;
     TIMSK0 |= _BV(OCIE0A);
-    OCR0A = 0x91;
+    OCR0A = SYSCLOCK_TOP;
     sei();
 }
 
@@ -0,0 +1,61 @@
+// timers - one-shot and periodic callbacks with Library/timers.S
+// The white LED blinks once a second throughout. The red LED blinks fast
+// for 5 s, then a one-shot timer stops it, and another one-shot starts it
+// again 3 s later. No timing variables in the main loop.
+// PB0 carries the sysclock OC0A square wave, so the LEDs are on PB3 and PB4.
+
+#include <avr/io.h>
+#include "sysclock_asm.h"
+#include "timers_asm.h"
+
+#define WHITE 3         // white LED to pin 3
+#define RED 4           // red LED to pin 4
+
+// timer ids, the order of the table below
+enum { T_WHITE, T_RED, T_RED_OFF, T_RED_ON };
+
+static void white(void)
+{
+    PINB = _BV(WHITE);                      // toggle
+}
+
+static void red(void)
+{
+    PINB = _BV(RED);
+}
+
+static void red_off(void)
+{
+    timer_stop(T_RED);
+    PORTB &= ~_BV(RED);
+    timer_start(T_RED_ON, 3000);
+}
+
+static void red_on(void)
+{
+    timer_start(T_RED, 1);
+    timer_start(T_RED_OFF, 5000);
+}
+
+// function, period (ticks), 0 for one-shot
+static const struct timer timers[TIMER_MAX] PROGMEM = {
+    [T_WHITE] = { white, 500 },
+    [T_RED] = { red, 100 },
+    [T_RED_OFF] = { red_off, 0 },
+    [T_RED_ON] = { red_on, 0 },
+};
+
+int main(void)
+{
+    init_sysclock_1k();
+    DDRB |= (_BV(WHITE) | _BV(RED));
+
+    timer_init(timers);
+    timer_start(T_WHITE, 500);
+    red_on();
+
+    while (1)
+    {
+        timer_poll();
+    }
+}
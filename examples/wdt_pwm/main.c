@@ -0,0 +1,61 @@
+// wdt_pwm - hardware PWM on Timer0 with the watchdog as the timebase
+// Library/wdtclock.S keeps ticks() in milliseconds from the WDT interrupt,
+// leaving Timer0 to fade a LED on OC0A (PB0) with fast PWM. The fade steps
+// on ticks() and the CPU sleeps in idle between WDT interrupts, no
+// _delay_ms busy-waits. Every 10 s the LED goes off and the chip powers
+// down for 5 s, woken by the same WDT interrupt.
+
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include "wdtclock_asm.h"
+
+#define LED PB0         // OC0A
+
+#define FADE_STEP 16    // ticks (ms) per brightness step, one WDT period
+#define AWAKE 10000     // ms of fading
+#define ASLEEP 5000     // ms powered down
+
+static void pwm_on(void)
+{
+    TCCR0A = _BV(COM0A1) | _BV(WGM01) | _BV(WGM00);    // fast PWM, OC0A
+    TCCR0B = _BV(CS01);                                 // /8
+}
+
+static void pwm_off(void)
+{
+    TCCR0A = 0;                                         // OC0A disconnected
+    TCCR0B = 0;
+    PORTB &= ~_BV(LED);
+}
+
+int main(void)
+{
+    init_wdtclock(WDTCLOCK_16MS);
+    DDRB |= _BV(LED);
+    set_sleep_mode(SLEEP_MODE_IDLE);
+
+    while (1)
+    {
+        uint16_t start = ticks();
+        uint16_t step = start;
+        uint8_t level = 0;
+        int8_t dir = 4;
+
+        pwm_on();
+        while ((uint16_t)(ticks() - start) < AWAKE)
+        {
+            if ((uint16_t)(ticks() - step) >= FADE_STEP)
+            {
+                step += FADE_STEP;
+                if ((level == 252 && dir > 0) || (level == 0 && dir < 0))
+                    dir = -dir;
+                level += dir;
+                OCR0A = level;
+            }
+            sleep_mode();           // idle, PWM keeps running
+        }
+
+        pwm_off();
+        wdtclock_sleep(ticks() + ASLEEP);
+    }
+}